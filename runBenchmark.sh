@@ -0,0 +1,20 @@
+# benchmark of GetTrackingSyst and ComputeUncertainty on synthetic fPIDtrees,
+# results in benchmark_*.json (sizes: entries of the data and MC trees, up to 500000000)
+# usage: source runBenchmark.sh [nThreads] [sizes...]
+nThreads=${1:-1}
+sizes=${@:2}
+sizes=${sizes:-"1000000 10000000"}
+for n in $sizes; do
+  # from the trees, then skimming the track caches, then from the caches
+  rm -f synthetic_*_$n.root.*.pidcache
+  root -q -b -l BenchmarkTracking.C++"($n,$nThreads,\"benchmark_tracking_$n.json\")"
+  root -q -b -l BenchmarkTracking.C++"($n,$nThreads,\"benchmark_tracking_skim_$n.json\",kTRUE)"
+  root -q -b -l BenchmarkTracking.C++"($n,$nThreads,\"benchmark_tracking_cache_$n.json\",kTRUE)"
+done
+# trials with the decays generated, then folded from the kinematics file
+# (TPC uncertainties from the last synthetic trees)
+rm -f Kinematics_Toy_*.dat
+root -q -b -l -e 'gROOT->LoadMacro("ComputeUncertainty.C++")' -e 'fBenchmarkJSON="benchmark_uncertainty.json"' \
+  -e "ComputeUncertainty(k18r,kCentral,kFit,\".\",$nThreads,1)"
+root -q -b -l -e 'gROOT->LoadMacro("ComputeUncertainty.C++")' -e 'fBenchmarkJSON="benchmark_uncertainty_fold.json"' \
+  -e "ComputeUncertainty(k18r,kCentral,kFit,\".\",$nThreads,1)"
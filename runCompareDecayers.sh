@@ -0,0 +1,14 @@
+# daughter pT spectra of the built-in decayer vs TPythia6Decayer, same decay, pT shape and
+# TPC/matching tables, independent seeds; results in CompareDecayers.root
+# usage: source runCompareDecayers.sh [pathTPC] [nThreads] [totTrials]
+pathTPC=${1:-RunAll}
+nThreads=${2:-1}
+trials=${3:-10000000}
+for decayer in kPythia6Decayer kNativeDecayer; do
+  seed=1
+  if [ $decayer = kNativeDecayer ]; then seed=2; fi
+  root -q -b -l -e 'gROOT->LoadMacro("ComputeUncertainty.C++")' -e "fDecayer=$decayer" -e 'fUseKinematicsFile=kFALSE' \
+    -e "totTrials=$trials" -e "ComputeUncertainty(k18r,kCentral,kFit,\"$pathTPC\",$nThreads,$seed)"
+  mv $(ls -t Acceptance_Toy_*.root | head -1) CompareDecayers_$decayer.root
+done
+root -q -b -l CompareDecayers.C++'("CompareDecayers_kPythia6Decayer.root","CompareDecayers_kNativeDecayer.root")'
@@ -1 +1,19 @@
-root -q -b -l GetTrackingSyst.C++'(kCentral,k18r,kPionCuts,"AnalysisResults_data.root","AnalysisResults_MC.root",kTRUE)'
+#root -q -b -l GetTrackingSyst.C++'(kCentral,k18r,kPionCuts,"AnalysisResults_data.root","AnalysisResults_MC.root",kTRUE)'
+# all configurations needed by ComputeUncertainty.C, each fPIDtree is read once; the period
+# is selected by the file (LHC18q and LHC18r outputs use the same directories)
+# usage: source runTrackingSyst.sh [data_18r] [mc_18r] [data_18q] [mc_18q] [nThreads]
+data18r=${1:-AnalysisResults_data_18r.root}
+mc18r=${2:-AnalysisResults_MC_18r.root}
+data18q=${3:-AnalysisResults_data_18q.root}
+mc18q=${4:-AnalysisResults_MC_18q.root}
+nThreads=${5:-1}
+root -q -b -l -e 'gROOT->LoadMacro("GetTrackingSyst.C++")' \
+  -e "AddSystConfig(kCentral,k18r,kPionCuts,kTRUE,\"$data18r\",\"$mc18r\")" \
+  -e "AddSystConfig(kCentral,k18r,kProtonCuts,kTRUE,\"$data18r\",\"$mc18r\")" \
+  -e "AddSystConfig(kCentral,k18q,kPionCuts,kTRUE,\"$data18q\",\"$mc18q\")" \
+  -e "AddSystConfig(kCentral,k18q,kProtonCuts,kTRUE,\"$data18q\",\"$mc18q\")" \
+  -e "AddSystConfig(kSemiCentral,k18r,kPionCuts,kTRUE,\"$data18r\",\"$mc18r\")" \
+  -e "AddSystConfig(kSemiCentral,k18r,kProtonCuts,kTRUE,\"$data18r\",\"$mc18r\")" \
+  -e "AddSystConfig(kSemiCentral,k18q,kPionCuts,kTRUE,\"$data18q\",\"$mc18q\")" \
+  -e "AddSystConfig(kSemiCentral,k18q,kProtonCuts,kTRUE,\"$data18q\",\"$mc18q\")" \
+  -e "GetTrackingSystBatch(\"\",\"\",$nThreads)"